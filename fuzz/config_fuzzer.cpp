@@ -0,0 +1,69 @@
+/**
+ * @file config_fuzzer.cpp
+ * @author Luke Houston (Romket) (lukehouston08@gmail.com)
+ * @brief libFuzzer entry point for config parsing
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 Luke Houston
+ *
+ * This file is part of ccase-check.  ccase-check is free software:
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as publishedby the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <scanner.h>
+
+#include <c4/std/string.hpp>
+#include <ryml.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    // ryml aborts on malformed input by default
+    void throwOnError(const char* msg, std::size_t length, ryml::Location,
+                      void*)
+    {
+        throw std::runtime_error {std::string {msg, length}};
+    }
+} // namespace
+
+extern "C" int LLVMFuzzerInitialize(int*, char***)
+{
+    ryml::set_callbacks(ryml::Callbacks {nullptr, nullptr, nullptr,
+                                         throwOnError});
+    std::cout.setstate(std::ios::failbit);
+    return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data,
+                                      std::size_t         size)
+{
+    Scanner scanner {ScanInfo {}};
+
+    try
+    {
+        scanner.ParseConfig(
+            std::string {reinterpret_cast<const char*>(data), size});
+    }
+    catch (const std::runtime_error&)
+    {
+    }
+
+    return 0;
+}
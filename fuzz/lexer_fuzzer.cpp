@@ -0,0 +1,70 @@
+/**
+ * @file lexer_fuzzer.cpp
+ * @author Luke Houston (Romket) (lukehouston08@gmail.com)
+ * @brief libFuzzer entry point for the Lexer class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 Luke Houston
+ *
+ * This file is part of ccase-check.  ccase-check is free software:
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as publishedby the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <lexer.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    std::vector<std::string> lex(std::string_view source,
+                                 std::size_t      chunkSize)
+    {
+        std::vector<std::string>   tokens;
+        const Lexer::TokenCallback onToken {[&](const Token& token) {
+            tokens.emplace_back(token.Text);
+            tokens.back() += std::to_string(token.Line);
+            tokens.back() += token.Prev;
+            tokens.back() += token.Between;
+        }};
+
+        Lexer lexer;
+        for (std::size_t i = 0; i < source.size(); i += chunkSize)
+            lexer.Feed(source.substr(i, chunkSize), onToken);
+        tokens.emplace_back(1, lexer.Finish(onToken));
+
+        return tokens;
+    }
+} // namespace
+
+// The first byte picks a chunk size; splitting the input must never change
+// the tokens produced
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data,
+                                      std::size_t         size)
+{
+    if (size == 0) return 0;
+
+    const std::size_t chunkSize {static_cast<std::size_t>(data[0]) + 1};
+    std::string_view  source {reinterpret_cast<const char*>(data) + 1,
+                             size - 1};
+
+    if (lex(source, chunkSize) != lex(source, source.size() + 1)) std::abort();
+
+    return 0;
+}
@@ -0,0 +1,52 @@
+/**
+ * @file pattern_fuzzer.cpp
+ * @author Luke Houston (Romket) (lukehouston08@gmail.com)
+ * @brief libFuzzer entry point for case patterns
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 Luke Houston
+ *
+ * This file is part of ccase-check.  ccase-check is free software:
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as publishedby the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <convert.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Ignore files are not parsed yet, so config case patterns are the only
+// user-supplied patterns. std::regex recurses on its input, so long inputs
+// only find stack exhaustion in the standard library.
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data,
+                                      std::size_t         size)
+{
+    if (size > 256) return 0;
+
+    try
+    {
+        auto pattern {Convert::CaseNameToRegex(
+            std::string_view {reinterpret_cast<const char*>(data), size})};
+
+        std::regex_match("fooBar", pattern);
+        std::regex_match("FOO_BAR", pattern);
+    }
+    catch (const std::regex_error&)
+    {
+    }
+
+    return 0;
+}
@@ -26,6 +26,7 @@
 
 #include <contexts.h>
 #include <heterogeneous_lookup.h>
+#include <io_mode.h>
 
 #include <regex>
 #include <string>
@@ -39,6 +40,10 @@ public:
 
     static Contexts StrToContext(std::string_view contextString);
 
+    static std::string_view ContextToStr(Contexts context);
+
+    static IoMode StrToIoMode(std::string_view modeString);
+
 private:
     inline static const std::unordered_map<std::string, std::regex, stringHash,
                                            std::equal_to<>>
@@ -56,6 +61,8 @@ private:
         _strToContext {{"classDef", Contexts::cClass},
                        {"structDef", Contexts::cStruct},
                        {"enumDef", Contexts::cEnum},
+                       {"macroDef", Contexts::cMacro},
+                       {"namespaceDef", Contexts::cNamespace},
 
                        {"globalFunc", Contexts::cFunction},
                        {"globalVar", Contexts::cVariable},
@@ -66,4 +73,10 @@ private:
                        {"protectedVar", Contexts::cProtectedVariable},
                        {"privateFunc", Contexts::cPrivateFunction},
                        {"privateVar", Contexts::cPrivateVariable}};
+
+    inline static const std::unordered_map<std::string, IoMode, stringHash,
+                                           std::equal_to<>>
+        _strToIoMode {{"sync", IoMode::sync},
+                      {"pread", IoMode::pread},
+                      {"uring", IoMode::uring}};
 };
@@ -0,0 +1,62 @@
+/**
+ * @file intern_table.h
+ * @author Luke Houston (Romket) (lukehouston08@gmail.com)
+ * @brief definition for InternTable class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 Luke Houston
+ *
+ * This file is part of ccase-check.  ccase-check is free software:
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as publishedby the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * Assigns each distinct string a compact id. The table is split into shards,
+ * each with its own lock, so concurrent callers only contend when their
+ * strings hash to the same shard. Ids and the views returned by Lookup stay
+ * valid for the lifetime of the table.
+ */
+class InternTable
+{
+public:
+    using Id = std::uint32_t;
+
+    Id               Intern(std::string_view str);
+    std::string_view Lookup(Id id) const;
+    std::size_t      Size() const;
+
+private:
+    static constexpr std::size_t _shardCount {16};
+
+    struct Shard
+    {
+        mutable std::mutex                       Mutex;
+        std::unordered_map<std::string_view, Id> Ids;
+        std::deque<std::string>                  Strings;
+    };
+
+    std::array<Shard, _shardCount> _shards;
+};
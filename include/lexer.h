@@ -0,0 +1,107 @@
+/**
+ * @file lexer.h
+ * @author Luke Houston (Romket) (lukehouston08@gmail.com)
+ * @brief definition for resumable Lexer class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 Luke Houston
+ *
+ * This file is part of ccase-check.  ccase-check is free software:
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as publishedby the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+struct Token
+{
+    enum class Kind
+    {
+        identifier,
+        directive
+    };
+
+    Kind             Type;
+    std::string_view Text;
+    std::size_t      Line;
+
+    // Last non-whitespace character before the token, or '\0' if none
+    char Prev;
+
+    // First non-whitespace character after the previous token, or '\0' if
+    // only whitespace and comments separate them
+    char Between;
+};
+
+/**
+ * Splits C/C++ source into identifier tokens, skipping comments, string (raw
+ * or not) and character literals, and numbers. Input may be fed in
+ * arbitrarily sized chunks; state (including a partially read identifier)
+ * carries over between calls to Feed, so a file never needs to be held in
+ * memory all at once.
+ *
+ * Token::Text is only valid for the duration of the callback.
+ */
+class Lexer
+{
+public:
+    using TokenCallback = std::function<void(const Token&)>;
+
+    void Feed(std::string_view chunk, const TokenCallback& onToken);
+
+    // Returns what Token::Between would be for a token at the end of input
+    char Finish(const TokenCallback& onToken);
+    void Reset();
+
+    // What Token::Between would be for a token starting at the current
+    // position, ignoring any partially read identifier
+    char Between() const;
+
+private:
+    enum class State
+    {
+        code,
+        identifier,
+        number,
+        lineComment,
+        blockComment,
+        stringLiteral,
+        charLiteral,
+        rawDelimiter,
+        rawString
+    };
+
+    void emit(std::string_view text, const TokenCallback& onToken);
+
+    State       _state {State::code};
+    std::string _partial;
+    std::string _rawEnd;
+    std::size_t _rawMatched {0};
+    std::size_t _line {1};
+    char        _last {'\0'};
+    char        _tokenPrev {'\0'};
+    char        _gapFirst {'\0'};
+    char        _tokenBetween {'\0'};
+    bool        _escaped {false};
+    bool        _pendingSlash {false};
+    bool        _pendingStar {false};
+    bool        _lineStart {true};
+    bool        _afterHash {false};
+    bool        _tokenIsDirective {false};
+};
@@ -26,9 +26,11 @@
 
 #include <scanner.h>
 
+#include <cstdint>
 #include <expected>
 #include <optional>
 #include <string>
+#include <string_view>
 
 enum PathType
 {
@@ -50,7 +52,10 @@ struct Error
         multipleConfigs   = 8,
         multipleIgnores   = 9,
         unknownOption     = 10,
-        extraOptions      = 11
+        extraOptions      = 11,
+        invalidSize       = 12,
+        invalidIoMode     = 13,
+        invalidIoWindow   = 14
     };
 
     ErrType     Type;
@@ -81,5 +86,7 @@ private:
     static const std::optional<Error>
     handleCodePath(const std::string_view path, ScanInfo& info);
 
+    static std::optional<std::uintmax_t> parseSize(std::string_view size);
+
     static void displayArgs();
 };
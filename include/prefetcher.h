@@ -0,0 +1,66 @@
+/**
+ * @file prefetcher.h
+ * @author Luke Houston (Romket) (lukehouston08@gmail.com)
+ * @brief definition for Prefetcher class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 Luke Houston
+ *
+ * This file is part of ccase-check.  ccase-check is free software:
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as publishedby the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <io_mode.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+struct PrefetchedFile
+{
+    std::filesystem::path Path;
+    std::string           Contents;
+    bool                  Truncated {false};
+    bool                  Loaded {false};
+};
+
+/**
+ * Reads whole files ahead of the lexer. Up to `window` files are in flight at
+ * once; Pop returns them in the order they were pushed. Callers must Pop
+ * before pushing into a full window, so traversal can never run further
+ * ahead of lexing than the window allows.
+ */
+class Prefetcher
+{
+public:
+    // Returns nullptr for IoMode::sync, and falls back to the pread pool if
+    // io_uring is unavailable
+    static std::unique_ptr<Prefetcher> Create(IoMode mode, std::size_t window);
+
+    virtual ~Prefetcher() = default;
+
+    virtual bool Full() const  = 0;
+    virtual bool Empty() const = 0;
+
+    // Reads at most `size` bytes of `path`
+    virtual void Push(std::filesystem::path path, std::uintmax_t size,
+                      bool truncated) = 0;
+
+    virtual PrefetchedFile Pop() = 0;
+};
@@ -25,9 +25,19 @@
 #pragma once
 
 #include <contexts.h>
+#include <heterogeneous_lookup.h>
+#include <intern_table.h>
+#include <io_mode.h>
+#include <lexer.h>
+#include <prefetcher.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <memory>
+#include <optional>
 #include <regex>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -36,6 +46,16 @@ struct ScanInfo
     std::filesystem::path              ConfigPath {".ccase-check"};
     std::filesystem::path              IgnorePath {".ccase-check-ignore"};
     std::vector<std::filesystem::path> ToScan;
+
+    // 0 means no limit
+    std::uintmax_t MaxFileSize {0};
+    bool           SampleOversized {false};
+    std::size_t    ChunkSize {64 * 1024};
+
+    bool Report {false};
+
+    IoMode      Io {IoMode::sync};
+    std::size_t IoWindow {32};
 };
 
 class Scanner
@@ -45,6 +65,8 @@ public:
 
     int Run();
 
+    int ParseConfig(std::string&& configText);
+
 private:
     int  loadConfig();
     void loadIgnore();
@@ -52,6 +74,37 @@ private:
     bool scanDir(const std::filesystem::path&& dir);
     bool scanFile(const std::filesystem::path&& file);
 
+    bool lexPrefetched();
+    bool drainPrefetched();
+    void finishFile(bool truncated, const Lexer::TokenCallback& onToken);
+
+    void handleToken(const std::filesystem::path& file, const Token& token);
+    void checkName(const std::filesystem::path& file, Contexts context,
+                   const Token& token);
+    void resolveCandidate(char next);
+
+    void printReport() const;
+
+    struct Symbol
+    {
+        std::size_t   Count {0};
+        std::uint32_t FirstFile {0};
+        bool          Matches {true};
+    };
+
+    struct DeclCandidate
+    {
+        std::filesystem::path File;
+        Contexts              Context;
+        std::string           Text;
+        std::size_t           Line;
+        char                  Prev;
+
+        // Set once a second name directly followed the first, as in
+        // `class FOO_API Widget` or `struct stat st`
+        bool AfterName {false};
+    };
+
     std::unordered_map<Contexts, std::regex> _patternMap;
 
     std::vector<std::regex> _ignorePatterns;
@@ -59,4 +112,41 @@ private:
     std::filesystem::path              _configPath;
     std::filesystem::path              _ignorePath;
     std::vector<std::filesystem::path> _toScan;
+
+    std::uintmax_t _maxFileSize;
+    bool           _sampleOversized;
+    bool           _report;
+
+    Lexer                       _lexer;
+    std::string                 _buffer;
+    std::unique_ptr<Prefetcher> _prefetcher;
+
+    std::optional<Contexts> _pendingContext;
+    bool                    _lastWasUsing {false};
+
+    // A name after class/struct/enum, held back until the next token shows
+    // whether it is declared there or only used as a type
+    std::optional<DeclCandidate> _declCandidate;
+
+    std::size_t             _violations {0};
+
+    // Without --report, regex results are memoized by context byte and name
+    // in a cache that is cleared once it reaches a fixed size
+    std::unordered_map<std::string, bool> _matchMemo;
+    std::string                           _memoKey;
+
+    // Only filled with --report. Keyed by context in the high 32 bits and
+    // interned name in the low 32, so each distinct declaration is only
+    // matched against its regex once
+    InternTable                               _names;
+    std::unordered_map<std::uint64_t, Symbol> _symbols;
+    std::vector<std::filesystem::path>        _reportFiles;
+    std::optional<std::uint32_t>              _currentReportFile;
+
+    inline static const std::unordered_map<std::string, Contexts, stringHash,
+                                           std::equal_to<>>
+        _keywordToContext {{"class", Contexts::cClass},
+                           {"struct", Contexts::cStruct},
+                           {"enum", Contexts::cEnum},
+                           {"namespace", Contexts::cNamespace}};
 };
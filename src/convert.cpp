@@ -40,3 +40,22 @@ Contexts Convert::StrToContext(std::string_view contextString)
     throw std::invalid_argument {"Invalid option \"" +
                                  std::string {contextString} + "\"."};
 }
+
+std::string_view Convert::ContextToStr(Contexts context)
+{
+    for (const auto& [str, c] : _strToContext)
+    {
+        if (c == context) return str;
+    }
+
+    throw std::invalid_argument {"Unknown context."};
+}
+
+IoMode Convert::StrToIoMode(std::string_view modeString)
+{
+    auto it = _strToIoMode.find(modeString);
+    if (it != _strToIoMode.end()) return it->second;
+
+    throw std::invalid_argument {"Invalid I/O mode \"" +
+                                 std::string {modeString} + "\"."};
+}
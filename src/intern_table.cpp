@@ -0,0 +1,68 @@
+/**
+ * @file intern_table.cpp
+ * @author Luke Houston (Romket) (lukehouston08@gmail.com)
+ * @brief InternTable class implementation
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 Luke Houston
+ *
+ * This file is part of ccase-check.  ccase-check is free software:
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as publishedby the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <intern_table.h>
+
+#include <functional>
+
+// The low bits of an id select the shard, the rest index into it
+InternTable::Id InternTable::Intern(std::string_view str)
+{
+    const std::size_t shardIndex {std::hash<std::string_view> {}(str) %
+                                  _shardCount};
+    Shard&            shard {_shards[shardIndex]};
+
+    std::lock_guard lock {shard.Mutex};
+
+    auto it {shard.Ids.find(str)};
+    if (it != shard.Ids.end()) return it->second;
+
+    const Id id {static_cast<Id>(shard.Strings.size() * _shardCount +
+                                 shardIndex)};
+
+    shard.Ids.emplace(shard.Strings.emplace_back(str), id);
+
+    return id;
+}
+
+std::string_view InternTable::Lookup(Id id) const
+{
+    const Shard& shard {_shards[id % _shardCount]};
+
+    std::lock_guard lock {shard.Mutex};
+    return shard.Strings[id / _shardCount];
+}
+
+std::size_t InternTable::Size() const
+{
+    std::size_t size {0};
+
+    for (const Shard& shard : _shards)
+    {
+        std::lock_guard lock {shard.Mutex};
+        size += shard.Strings.size();
+    }
+
+    return size;
+}
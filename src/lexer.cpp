@@ -0,0 +1,287 @@
+/**
+ * @file lexer.cpp
+ * @author Luke Houston (Romket) (lukehouston08@gmail.com)
+ * @brief Lexer class implementation
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 Luke Houston
+ *
+ * This file is part of ccase-check.  ccase-check is free software:
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as publishedby the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <lexer.h>
+
+namespace
+{
+    bool isIdentStart(char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' ||
+               static_cast<unsigned char>(c) >= 0x80;
+    }
+
+    bool isIdentChar(char c)
+    {
+        return isIdentStart(c) || (c >= '0' && c <= '9');
+    }
+
+    bool isRawPrefix(std::string_view text)
+    {
+        return text == "R" || text == "LR" || text == "uR" || text == "UR" ||
+               text == "u8R";
+    }
+
+    // Raw string delimiters are at most 16 characters
+    constexpr std::size_t maxRawEnd {16 + 2};
+} // namespace
+
+void Lexer::Feed(std::string_view chunk, const TokenCallback& onToken)
+{
+    std::size_t start {0};
+
+    for (std::size_t i = 0; i < chunk.size(); ++i)
+    {
+        const char c {chunk[i]};
+
+        switch (_state)
+        {
+            case State::identifier:
+            {
+                if (isIdentChar(c)) continue;
+
+                if (!_partial.empty())
+                    _partial.append(chunk.substr(start, i - start));
+
+                const std::string_view text {
+                    _partial.empty() ? chunk.substr(start, i - start)
+                                     : std::string_view {_partial}};
+
+                if (c == '"' && isRawPrefix(text))
+                {
+                    if (_gapFirst == '\0') _gapFirst = '"';
+
+                    _state  = State::rawDelimiter;
+                    _rawEnd = ")";
+                    _partial.clear();
+                    continue;
+                }
+
+                emit(text, onToken);
+                _partial.clear();
+
+                _state = State::code;
+                break;
+            }
+            case State::number:
+                if (isIdentChar(c) || c == '.' || c == '\'')
+                {
+                    _last = c;
+                    continue;
+                }
+
+                _state = State::code;
+                break;
+            case State::lineComment:
+                if (c == '\n')
+                {
+                    ++_line;
+                    _state     = State::code;
+                    _lineStart = true;
+                }
+                continue;
+            case State::blockComment:
+                if (c == '\n') ++_line;
+                if (_pendingStar && c == '/') _state = State::code;
+                _pendingStar = c == '*';
+                continue;
+            case State::stringLiteral:
+            case State::charLiteral:
+                if (_escaped)
+                {
+                    if (c == '\n') ++_line;
+                    _escaped = false;
+                }
+                else if (c == '\\')
+                {
+                    _escaped = true;
+                }
+                else if (c == '\n')
+                {
+                    // Unterminated, e.g. an apostrophe in #error text
+                    ++_line;
+                    _state     = State::code;
+                    _lineStart = true;
+                    _afterHash = false;
+                }
+                else if (c == (_state == State::stringLiteral ? '"' : '\''))
+                {
+                    _state = State::code;
+                    _last  = c;
+                }
+                continue;
+            case State::rawDelimiter:
+                if (c == '(')
+                {
+                    _rawEnd += '"';
+                    _rawMatched = 0;
+                    _state      = State::rawString;
+                    continue;
+                }
+
+                if (c == ')' || c == '\\' || c == '"' || c == ' ' ||
+                    c == '\t' || c == '\n' || _rawEnd.size() == maxRawEnd - 1)
+                {
+                    // Not a valid raw string, so carry on as if it were code
+                    _state = State::code;
+                    break;
+                }
+
+                _rawEnd += c;
+                continue;
+            case State::rawString:
+                if (c == '\n') ++_line;
+
+                if (c == _rawEnd[_rawMatched])
+                {
+                    if (++_rawMatched == _rawEnd.size())
+                    {
+                        _state = State::code;
+                        _last  = c;
+                    }
+                }
+                else
+                {
+                    _rawMatched = c == ')' ? 1 : 0;
+                }
+                continue;
+            case State::code: break;
+        }
+
+        if (_pendingSlash)
+        {
+            _pendingSlash = false;
+
+            if (c == '/')
+            {
+                _state = State::lineComment;
+                continue;
+            }
+
+            if (c == '*')
+            {
+                _state       = State::blockComment;
+                _pendingStar = false;
+                continue;
+            }
+
+            _last      = '/';
+            _lineStart = false;
+            _afterHash = false;
+            if (_gapFirst == '\0') _gapFirst = '/';
+        }
+
+        if (c == '\n')
+        {
+            ++_line;
+            _lineStart = true;
+            _afterHash = false;
+            continue;
+        }
+
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f')
+            continue;
+
+        if (c == '/')
+        {
+            _pendingSlash = true;
+            continue;
+        }
+
+        if (isIdentStart(c))
+        {
+            _state            = State::identifier;
+            start             = i;
+            _tokenPrev        = _last;
+            _tokenBetween     = _gapFirst;
+            _tokenIsDirective = _afterHash;
+        }
+        else if (c >= '0' && c <= '9')
+        {
+            _state = State::number;
+        }
+        else if (c == '"')
+        {
+            _state = State::stringLiteral;
+        }
+        else if (c == '\'')
+        {
+            _state = State::charLiteral;
+        }
+
+        if (_state != State::identifier && _gapFirst == '\0') _gapFirst = c;
+
+        _afterHash = c == '#' && _lineStart;
+        _lineStart = false;
+        _last      = c;
+    }
+
+    if (_state == State::identifier) _partial.append(chunk.substr(start));
+}
+
+char Lexer::Finish(const TokenCallback& onToken)
+{
+    if (_state == State::identifier && !_partial.empty())
+        emit(_partial, onToken);
+
+    const char between {Between()};
+
+    Reset();
+    return between;
+}
+
+char Lexer::Between() const
+{
+    // A slash still waiting to see if it starts a comment counts as code
+    return _pendingSlash && _gapFirst == '\0' ? '/' : _gapFirst;
+}
+
+void Lexer::Reset()
+{
+    _state = State::code;
+    _partial.clear();
+    _rawEnd.clear();
+    _rawMatched       = 0;
+    _line             = 1;
+    _last             = '\0';
+    _tokenPrev        = '\0';
+    _gapFirst         = '\0';
+    _tokenBetween     = '\0';
+    _escaped          = false;
+    _pendingSlash     = false;
+    _pendingStar      = false;
+    _lineStart        = true;
+    _afterHash        = false;
+    _tokenIsDirective = false;
+}
+
+void Lexer::emit(std::string_view text, const TokenCallback& onToken)
+{
+    _last     = text.back();
+    _gapFirst = '\0';
+
+    onToken(Token {_tokenIsDirective ? Token::Kind::directive
+                                     : Token::Kind::identifier,
+                   text, _line, _tokenPrev, _tokenBetween});
+}
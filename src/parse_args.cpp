@@ -24,7 +24,11 @@
 
 #include <parse_args.h>
 
+#include <convert.h>
+
+#include <charconv>
 #include <iostream>
+#include <limits>
 #include <utility>
 
 const std::expected<ScanInfo, Error> Parser::CommandLine(int argc, char** argv)
@@ -112,6 +116,16 @@ int Parser::DisplayErrors(const Error& err)
         case Error::ErrType::extraOptions:
             std::cout << "Error: too many arguments given\n";
             break;
+        case Error::ErrType::invalidSize:
+            std::cout << "Error: invalid size: " << err.Info << '\n';
+            break;
+        case Error::ErrType::invalidIoMode:
+            std::cout << "Error: invalid I/O mode: " << err.Info << '\n';
+            break;
+        case Error::ErrType::invalidIoWindow:
+            std::cout << "Error: I/O window must be a positive whole number: "
+                      << err.Info << '\n';
+            break;
         case Error::ErrType::dontScan: return 0;
     }
 
@@ -165,6 +179,61 @@ const std::optional<Error> Parser::handleOptions(const OptionInfo&& info)
                           info.Scan.IgnorePath};
         }
     }
+    else if (info.Option.substr(0, 14) == "max-file-size=")
+    {
+        auto size {parseSize(info.Arg.substr(16))};
+        if (!size)
+        {
+            return Error {Error::ErrType::invalidSize, std::string(info.Arg)};
+        }
+
+        info.Scan.MaxFileSize = *size;
+    }
+    else if (info.Option == "sample-oversized")
+    {
+        info.Scan.SampleOversized = true;
+    }
+    else if (info.Option == "report")
+    {
+        info.Scan.Report = true;
+    }
+    else if (info.Option.substr(0, 11) == "chunk-size=")
+    {
+        auto size {parseSize(info.Arg.substr(13))};
+        if (!size || *size == 0)
+        {
+            return Error {Error::ErrType::invalidSize, std::string(info.Arg)};
+        }
+
+        info.Scan.ChunkSize = static_cast<std::size_t>(*size);
+    }
+    else if (info.Option.substr(0, 3) == "io=")
+    {
+        try
+        {
+            info.Scan.Io = Convert::StrToIoMode(info.Arg.substr(5));
+        }
+        catch (const std::invalid_argument&)
+        {
+            return Error {Error::ErrType::invalidIoMode, std::string(info.Arg)};
+        }
+    }
+    else if (info.Option.substr(0, 10) == "io-window=")
+    {
+        const std::string_view window {info.Arg.substr(12)};
+        std::size_t            value {0};
+
+        auto [end, ec] {std::from_chars(window.data(),
+                                        window.data() + window.size(), value)};
+        if (ec != std::errc {} || end != window.data() + window.size() ||
+            value == 0)
+        {
+            return Error {Error::ErrType::invalidIoWindow,
+                          std::string(info.Arg)};
+        }
+
+        info.Scan.IoWindow = value;
+    }
     else if (info.Option.substr(0, 4) == "help")
     {
         if (info.Argc != 2) return Error {Error::ErrType::extraOptions};
@@ -197,10 +266,50 @@ Generic Options:\n\n\
 ccase-check options:\n\n\
   --config=<config path>        - Override the default config path If not\n\
                                   specified, the program will look for a\n\
-                                  .ccase-check file in the current directory."
+                                  .ccase-check file in the current directory.\n\
+  --max-file-size=<size>        - Skip files larger than <size> bytes. A K, M\n\
+                                  or G suffix may be given.\n\
+  --sample-oversized            - Scan only the first --max-file-size bytes\n\
+                                  of larger files instead of skipping them.\n\
+  --chunk-size=<size>           - Read files in chunks of <size> bytes\n\
+                                  (default 64K). This bounds the memory used\n\
+                                  per file, regardless of file size.\n\
+  --report                      - After scanning, print per-context naming\n\
+                                  statistics and names declared with\n\
+                                  inconsistent case across files.\n\
+  --io=<sync|pread|uring>       - How files are read (default sync). pread\n\
+                                  and uring read files that fit in one\n\
+                                  chunk ahead of the lexer, using a thread\n\
+                                  pool or io_uring. uring falls back to\n\
+                                  pread where it is unavailable.\n\
+  --io-window=<n>               - Number of files read ahead with --io=pread\n\
+                                  or --io=uring (default 32)."
               << std::endl;
 }
 
+std::optional<std::uintmax_t> Parser::parseSize(std::string_view size)
+{
+    std::uintmax_t value {0};
+
+    auto [end, ec] {
+        std::from_chars(size.data(), size.data() + size.size(), value)};
+    if (ec != std::errc {} || end == size.data()) return std::nullopt;
+
+    std::string_view suffix {end, size.data() + size.size()};
+
+    int shift {0};
+    if (suffix == "K") shift = 10;
+    else if (suffix == "M") shift = 20;
+    else if (suffix == "G") shift = 30;
+    else if (!suffix.empty()) return std::nullopt;
+
+    // Reject sizes that would wrap around once the suffix is applied
+    if (value > std::numeric_limits<std::uintmax_t>::max() >> shift)
+        return std::nullopt;
+
+    return value << shift;
+}
+
 const std::optional<Error> Parser::handleCodePath(std::string_view path,
                                                   ScanInfo&        info)
 {
@@ -0,0 +1,401 @@
+/**
+ * @file prefetcher.cpp
+ * @author Luke Houston (Romket) (lukehouston08@gmail.com)
+ * @brief Prefetcher implementations using io_uring or a pread thread pool
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 Luke Houston
+ *
+ * This file is part of ccase-check.  ccase-check is free software:
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as publishedby the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <prefetcher.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+    #include <fstream>
+#else
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+#ifdef CCASE_CHECK_HAS_IO_URING
+    #include <liburing.h>
+#endif
+
+namespace
+{
+    struct Slot
+    {
+        PrefetchedFile File;
+        std::uintmax_t Size;
+        bool           Done {false};
+    };
+
+    void readFile(Slot& slot)
+    {
+        slot.File.Contents.resize(slot.Size);
+
+#ifdef _WIN32
+        std::ifstream stream {slot.File.Path, std::ios::binary};
+        if (!stream) return;
+
+        stream.read(slot.File.Contents.data(),
+                    static_cast<std::streamsize>(slot.Size));
+        if (stream.bad()) return;
+
+        slot.File.Contents.resize(static_cast<std::size_t>(stream.gcount()));
+#else
+        const int fd {::open(slot.File.Path.c_str(), O_RDONLY | O_CLOEXEC)};
+        if (fd < 0) return;
+
+        std::size_t offset {0};
+        bool        failed {false};
+        while (offset < slot.Size)
+        {
+            const ssize_t count {::pread(fd, slot.File.Contents.data() + offset,
+                                         slot.Size - offset,
+                                         static_cast<off_t>(offset))};
+            if (count < 0 && errno == EINTR) continue;
+
+            // 0 is end of file, e.g. if it shrank since its size was taken
+            failed = count < 0;
+            if (count <= 0) break;
+
+            offset += static_cast<std::size_t>(count);
+        }
+
+        ::close(fd);
+        if (failed) return;
+
+        slot.File.Contents.resize(offset);
+#endif
+
+        slot.File.Loaded = true;
+    }
+
+    class PreadPrefetcher : public Prefetcher
+    {
+    public:
+        explicit PreadPrefetcher(std::size_t window) : _window {window}
+        {
+            const std::size_t threadCount {std::clamp<std::size_t>(
+                std::thread::hardware_concurrency() * 2, 1, window)};
+
+            for (std::size_t i = 0; i < threadCount; ++i)
+            {
+                _workers.emplace_back(
+                    [this](std::stop_token stop) { work(stop); });
+            }
+        }
+
+        bool Full() const override { return _pending.size() >= _window; }
+        bool Empty() const override { return _pending.empty(); }
+
+        void Push(std::filesystem::path path, std::uintmax_t size,
+                  bool truncated) override
+        {
+            auto& slot {_pending.emplace_back(std::make_unique<Slot>(
+                PrefetchedFile {std::move(path), {}, truncated}, size))};
+
+            {
+                std::lock_guard lock {_mutex};
+                _jobs.push(slot.get());
+            }
+
+            _jobAdded.notify_one();
+        }
+
+        PrefetchedFile Pop() override
+        {
+            std::unique_ptr<Slot> slot {std::move(_pending.front())};
+            _pending.pop_front();
+
+            std::unique_lock lock {_mutex};
+            _jobDone.wait(lock, [&] { return slot->Done; });
+
+            return std::move(slot->File);
+        }
+
+    private:
+        void work(std::stop_token stop)
+        {
+            while (true)
+            {
+                Slot* slot;
+
+                {
+                    std::unique_lock lock {_mutex};
+                    if (!_jobAdded.wait(lock, stop,
+                                        [this] { return !_jobs.empty(); }))
+                        return;
+
+                    slot = _jobs.front();
+                    _jobs.pop();
+                }
+
+                readFile(*slot);
+
+                {
+                    std::lock_guard lock {_mutex};
+                    slot->Done = true;
+                }
+
+                _jobDone.notify_all();
+            }
+        }
+
+        std::size_t                       _window;
+        std::deque<std::unique_ptr<Slot>> _pending;
+
+        std::mutex                  _mutex;
+        std::condition_variable_any _jobAdded;
+        std::condition_variable     _jobDone;
+        std::queue<Slot*>           _jobs;
+
+        // Declared last so the workers are joined before anything they use
+        // is destroyed
+        std::vector<std::jthread> _workers;
+    };
+
+#ifdef CCASE_CHECK_HAS_IO_URING
+    /**
+     * Each file goes through openat, one or more reads, then close, with at
+     * most one operation per file in flight. New operations are queued while
+     * completions are handled and submitted together in one system call.
+     */
+    class UringPrefetcher : public Prefetcher
+    {
+    public:
+        static std::unique_ptr<Prefetcher> TryCreate(std::size_t window)
+        {
+            auto prefetcher {
+                std::unique_ptr<UringPrefetcher> {new UringPrefetcher}};
+
+            const auto entries {
+                static_cast<unsigned>(std::min<std::size_t>(window, 4096))};
+            if (io_uring_queue_init(entries, &prefetcher->_ring, 0) < 0)
+                return nullptr;
+
+            prefetcher->_initialized = true;
+            prefetcher->_window      = window;
+
+            io_uring_probe* probe {io_uring_get_probe_ring(&prefetcher->_ring)};
+            if (!probe) return nullptr;
+
+            const bool supported {
+                io_uring_opcode_supported(probe, IORING_OP_OPENAT) &&
+                io_uring_opcode_supported(probe, IORING_OP_READ) &&
+                io_uring_opcode_supported(probe, IORING_OP_CLOSE)};
+            io_uring_free_probe(probe);
+
+            if (!supported) return nullptr;
+            return prefetcher;
+        }
+
+        ~UringPrefetcher() override
+        {
+            if (!_initialized) return;
+
+            // The kernel may still write into pending buffers
+            while (!_pending.empty())
+            {
+                if (!_pending.front()->Done) waitAndHandle();
+                else _pending.pop_front();
+            }
+
+            io_uring_queue_exit(&_ring);
+        }
+
+        bool Full() const override { return _pending.size() >= _window; }
+        bool Empty() const override { return _pending.empty(); }
+
+        void Push(std::filesystem::path path, std::uintmax_t size,
+                  bool truncated) override
+        {
+            auto& slot {_pending.emplace_back(std::make_unique<UringSlot>(
+                Slot {PrefetchedFile {std::move(path), {}, truncated}, size}))};
+
+            slot->File.Contents.resize(size);
+
+            io_uring_sqe* sqe {getSqe()};
+            io_uring_prep_openat(sqe, AT_FDCWD, slot->File.Path.c_str(),
+                                 O_RDONLY | O_CLOEXEC, 0);
+            io_uring_sqe_set_data(sqe, slot.get());
+
+            // Submit the first window as one batch
+            if (Full()) io_uring_submit(&_ring);
+        }
+
+        PrefetchedFile Pop() override
+        {
+            while (!_pending.front()->Done) waitAndHandle();
+
+            std::unique_ptr<UringSlot> slot {std::move(_pending.front())};
+            _pending.pop_front();
+
+            // Keep the rest of the window moving while the caller lexes
+            io_uring_submit(&_ring);
+
+            return std::move(slot->File);
+        }
+
+    private:
+        UringPrefetcher() = default;
+
+        enum class Stage
+        {
+            opening,
+            reading,
+            closing
+        };
+
+        struct UringSlot : Slot
+        {
+            Stage       Step {Stage::opening};
+            int         Fd {-1};
+            std::size_t Offset {0};
+        };
+
+        io_uring_sqe* getSqe()
+        {
+            io_uring_sqe* sqe {io_uring_get_sqe(&_ring)};
+            if (sqe) return sqe;
+
+            io_uring_submit(&_ring);
+            return io_uring_get_sqe(&_ring);
+        }
+
+        void waitAndHandle()
+        {
+            io_uring_submit_and_wait(&_ring, 1);
+
+            io_uring_cqe* cqe;
+            unsigned      head;
+            unsigned      count {0};
+
+            io_uring_for_each_cqe(&_ring, head, cqe)
+            {
+                handle(*static_cast<UringSlot*>(io_uring_cqe_get_data(cqe)),
+                       cqe->res);
+                ++count;
+            }
+
+            io_uring_cq_advance(&_ring, count);
+        }
+
+        void handle(UringSlot& slot, int result)
+        {
+            switch (slot.Step)
+            {
+                case Stage::opening:
+                    if (result < 0)
+                    {
+                        slot.Done = true;
+                        return;
+                    }
+
+                    slot.Fd = result;
+                    queueRead(slot);
+                    return;
+                case Stage::reading:
+                    if (result == -EINTR || result == -EAGAIN)
+                    {
+                        queueRead(slot);
+                        return;
+                    }
+
+                    if (result > 0)
+                    {
+                        slot.Offset += static_cast<std::size_t>(result);
+                        if (slot.Offset < slot.Size)
+                        {
+                            queueRead(slot);
+                            return;
+                        }
+                    }
+
+                    slot.File.Contents.resize(slot.Offset);
+                    slot.File.Loaded = result >= 0;
+                    queueClose(slot);
+                    return;
+                case Stage::closing: slot.Done = true; return;
+            }
+        }
+
+        void queueRead(UringSlot& slot)
+        {
+            if (slot.Offset >= slot.Size)
+            {
+                slot.File.Loaded = true;
+                queueClose(slot);
+                return;
+            }
+
+            slot.Step = Stage::reading;
+
+            const auto length {static_cast<unsigned>(
+                std::min<std::uintmax_t>(slot.Size - slot.Offset, 1u << 30))};
+
+            io_uring_sqe* sqe {getSqe()};
+            io_uring_prep_read(sqe, slot.Fd,
+                               slot.File.Contents.data() + slot.Offset, length,
+                               slot.Offset);
+            io_uring_sqe_set_data(sqe, &slot);
+        }
+
+        void queueClose(UringSlot& slot)
+        {
+            slot.Step = Stage::closing;
+
+            io_uring_sqe* sqe {getSqe()};
+            io_uring_prep_close(sqe, slot.Fd);
+            io_uring_sqe_set_data(sqe, &slot);
+        }
+
+        io_uring                                _ring {};
+        bool                                    _initialized {false};
+        std::size_t                             _window {0};
+        std::deque<std::unique_ptr<UringSlot>> _pending;
+    };
+#endif
+} // namespace
+
+std::unique_ptr<Prefetcher> Prefetcher::Create(IoMode mode, std::size_t window)
+{
+    if (mode == IoMode::sync) return nullptr;
+
+    if (mode == IoMode::uring)
+    {
+#ifdef CCASE_CHECK_HAS_IO_URING
+        if (auto prefetcher {UringPrefetcher::TryCreate(window)})
+            return prefetcher;
+#endif
+
+        std::cout << "io_uring is unavailable, falling back to pread\n";
+    }
+
+    return std::make_unique<PreadPrefetcher>(window);
+}
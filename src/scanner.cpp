@@ -29,14 +29,36 @@
 #include <c4/std/string.hpp>
 #include <ryml.hpp>
 
+#include <algorithm>
+#include <cctype>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <utility>
+
+namespace
+{
+    bool isIdentChar(char c)
+    {
+        return c == '_' || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') ||
+               (c >= 'A' && c <= 'Z');
+    }
+
+    // Regex results kept without --report before the memo is cleared
+    constexpr std::size_t maxMemoSize {1 << 16};
+} // namespace
 
 Scanner::Scanner(const ScanInfo&& info)
 {
-    _configPath = std::move(info.ConfigPath);
-    _ignorePath = std::move(info.IgnorePath);
-    _toScan     = std::move(info.ToScan);
+    _configPath      = std::move(info.ConfigPath);
+    _ignorePath      = std::move(info.IgnorePath);
+    _toScan          = std::move(info.ToScan);
+    _maxFileSize     = info.MaxFileSize;
+    _sampleOversized = info.SampleOversized;
+    _report          = info.Report;
+
+    _buffer.resize(info.ChunkSize);
+    _prefetcher = Prefetcher::Create(info.Io, info.IoWindow);
 }
 
 int Scanner::Run()
@@ -55,12 +77,19 @@ int Scanner::Run()
         }
         else
         {
+            // Report files already read ahead before the error
+            if (!drainPrefetched()) return 1;
+
             std::cout << "Invalid file found: " << path << '\n';
             return -2;
         }
     }
 
-    return 0;
+    if (!drainPrefetched()) return 1;
+
+    if (_report) printReport();
+
+    return _violations == 0 ? 0 : 1;
 }
 
 int Scanner::loadConfig()
@@ -72,9 +101,12 @@ int Scanner::loadConfig()
         return -1;
     }
 
-    std::string configText {std::istreambuf_iterator<char>(file),
-                            std::istreambuf_iterator<char>()};
+    return ParseConfig(std::string {std::istreambuf_iterator<char>(file),
+                                    std::istreambuf_iterator<char>()});
+}
 
+int Scanner::ParseConfig(std::string&& configText)
+{
     ryml::Tree confTree {ryml::parse_in_place(ryml::to_substr(configText))};
 
     for (const ryml::ConstNodeRef&& node : confTree.rootref())
@@ -124,6 +156,8 @@ bool Scanner::scanDir(const std::filesystem::path&& dir)
         }
         else
         {
+            if (!drainPrefetched()) return false;
+
             std::cout << "Invalid file found: " << entry << '\n';
             return false;
         }
@@ -134,8 +168,350 @@ bool Scanner::scanDir(const std::filesystem::path&& dir)
 
 bool Scanner::scanFile(const std::filesystem::path&& file)
 {
-    // placeholder
-    std::cout << "Scanning " << file << '\n';
+    std::uintmax_t size {std::filesystem::file_size(file)};
+    bool           truncated {false};
+
+    if (_maxFileSize != 0 && size > _maxFileSize)
+    {
+        if (!_sampleOversized)
+        {
+            // Keep the notice in traversal order
+            if (!drainPrefetched()) return false;
+
+            std::cout << "Skipping " << file << ": larger than "
+                      << _maxFileSize << " bytes\n";
+            return true;
+        }
+
+        size      = _maxFileSize;
+        truncated = true;
+    }
+
+    // Files that fit in one chunk are prefetched, larger ones are streamed
+    if (_prefetcher && size <= _buffer.size())
+    {
+        if (_prefetcher->Full() && !lexPrefetched()) return false;
+
+        _prefetcher->Push(file, size, truncated);
+        return true;
+    }
+
+    // Keep diagnostics in traversal order
+    if (!drainPrefetched()) return false;
+
+    std::ifstream stream {file, std::ios::binary};
+    if (!stream)
+    {
+        std::cout << "Failed to open " << file << '\n';
+        return false;
+    }
+
+    const Lexer::TokenCallback onToken {
+        [&](const Token& token) { handleToken(file, token); }};
+
+    while (size != 0 && stream)
+    {
+        stream.read(_buffer.data(),
+                    static_cast<std::streamsize>(
+                        std::min<std::uintmax_t>(_buffer.size(), size)));
+
+        const auto count {static_cast<std::size_t>(stream.gcount())};
+        size -= count;
+
+        _lexer.Feed(std::string_view {_buffer.data(), count}, onToken);
+    }
+
+    finishFile(truncated, onToken);
+    return true;
+}
+
+bool Scanner::lexPrefetched()
+{
+    const PrefetchedFile file {_prefetcher->Pop()};
+    if (!file.Loaded)
+    {
+        std::cout << "Failed to open " << file.Path << '\n';
+        return false;
+    }
 
+    const Lexer::TokenCallback onToken {
+        [&](const Token& token) { handleToken(file.Path, token); }};
+
+    _lexer.Feed(file.Contents, onToken);
+    finishFile(file.Truncated, onToken);
     return true;
 }
+
+bool Scanner::drainPrefetched()
+{
+    while (_prefetcher && !_prefetcher->Empty())
+    {
+        if (!lexPrefetched()) return false;
+    }
+
+    return true;
+}
+
+void Scanner::finishFile(bool truncated, const Lexer::TokenCallback& onToken)
+{
+    // A sampled file is cut off mid-stream, so its last identifier may be
+    // truncated
+    if (truncated)
+    {
+        resolveCandidate(_lexer.Between());
+        _lexer.Reset();
+    }
+    else
+    {
+        resolveCandidate(_lexer.Finish(onToken));
+    }
+    _pendingContext.reset();
+    _currentReportFile.reset();
+    _lastWasUsing = false;
+
+    std::cout.flush();
+}
+
+void Scanner::handleToken(const std::filesystem::path& file,
+                          const Token&                 token)
+{
+    if (_declCandidate)
+    {
+        if (token.Type == Token::Kind::identifier && token.Between == '\0')
+        {
+            // Always followed by `{` or `:`, which decide instead
+            if (token.Text == "final") return;
+
+            // Either `class FOO_API Widget {` with an export macro, or
+            // `struct stat st;`; the token after the second name tells them
+            // apart. A third name in a row means neither was declared
+            if (!_declCandidate->AfterName)
+            {
+                _declCandidate->Text      = token.Text;
+                _declCandidate->Line      = token.Line;
+                _declCandidate->Prev      = token.Prev;
+                _declCandidate->AfterName = true;
+                return;
+            }
+
+            _declCandidate.reset();
+        }
+        else
+        {
+            resolveCandidate(token.Between);
+        }
+    }
+
+    if (token.Type == Token::Kind::directive)
+    {
+        _pendingContext.reset();
+        if (token.Text == "define") _pendingContext = Contexts::cMacro;
+        return;
+    }
+
+    const bool afterUsing {
+        std::exchange(_lastWasUsing, token.Text == "using")};
+
+    if (_pendingContext)
+    {
+        // enum class/enum struct, attributes and alignas can sit between the
+        // keyword and the name
+        if (*_pendingContext == Contexts::cEnum &&
+            (token.Text == "class" || token.Text == "struct"))
+            return;
+
+        if (token.Text == "alignas" || token.Text == "__attribute__" ||
+            token.Text == "__declspec" || token.Prev == '[' ||
+            token.Prev == '(' || token.Prev == ':')
+            return;
+
+        const Contexts context {*std::exchange(_pendingContext, std::nullopt)};
+
+        // Anything else in front of the next identifier means the keyword
+        // did not introduce a name, e.g. an anonymous struct
+        if (token.Prev == ']' || token.Prev == ')' || isIdentChar(token.Prev))
+        {
+            // `struct stat st;` or `sizeof(struct tm)` only use the type
+            if (context == Contexts::cClass || context == Contexts::cStruct ||
+                context == Contexts::cEnum)
+            {
+                _declCandidate = DeclCandidate {
+                    file,       context,   std::string {token.Text},
+                    token.Line, token.Prev};
+            }
+            else
+            {
+                checkName(file, context, token);
+            }
+        }
+
+        return;
+    }
+
+    auto it {_keywordToContext.find(token.Text)};
+    if (it == _keywordToContext.end()) return;
+
+    // Template parameters and using-directives are not declarations
+    if (token.Prev == '<' || token.Prev == ',') return;
+    if (it->second == Contexts::cNamespace && afterUsing) return;
+
+    _pendingContext = it->second;
+}
+
+void Scanner::resolveCandidate(char next)
+{
+    if (!_declCandidate) return;
+
+    const DeclCandidate candidate {*std::exchange(_declCandidate,
+                                                  std::nullopt)};
+
+    // Only a body, a base clause or a forward declaration declares the name;
+    // `*`, `&`, `)`, `,`, `>` and the like mean the type is only used
+    const bool declared {next == '{' || next == ':' ||
+                         (next == ';' && !candidate.AfterName)};
+    if (!declared) return;
+
+    checkName(candidate.File, candidate.Context,
+              Token {Token::Kind::identifier, candidate.Text, candidate.Line,
+                     candidate.Prev, '\0'});
+}
+
+void Scanner::checkName(const std::filesystem::path& file, Contexts context,
+                        const Token& token)
+{
+    auto pattern {_patternMap.find(context)};
+    if (pattern == _patternMap.end() && !_report) return;
+
+    bool matches {true};
+
+    if (_report)
+    {
+        const std::uint64_t key {
+            static_cast<std::uint64_t>(std::to_underlying(context)) << 32 |
+            _names.Intern(token.Text)};
+
+        auto [it, inserted] {_symbols.try_emplace(key)};
+        Symbol& symbol {it->second};
+
+        if (inserted)
+        {
+            if (pattern != _patternMap.end())
+            {
+                symbol.Matches = std::regex_match(
+                    token.Text.begin(), token.Text.end(), pattern->second);
+            }
+
+            if (!_currentReportFile)
+            {
+                _currentReportFile =
+                    static_cast<std::uint32_t>(_reportFiles.size());
+                _reportFiles.push_back(file);
+            }
+
+            symbol.FirstFile = *_currentReportFile;
+        }
+
+        ++symbol.Count;
+        matches = symbol.Matches;
+    }
+    else
+    {
+        _memoKey.assign(1, static_cast<char>(std::to_underlying(context)));
+        _memoKey += token.Text;
+
+        auto cached {_matchMemo.find(_memoKey)};
+        if (cached == _matchMemo.end())
+        {
+            if (_matchMemo.size() >= maxMemoSize) _matchMemo.clear();
+
+            cached = _matchMemo
+                         .emplace(_memoKey,
+                                  std::regex_match(token.Text.begin(),
+                                                   token.Text.end(),
+                                                   pattern->second))
+                         .first;
+        }
+
+        matches = cached->second;
+    }
+
+    if (matches) return;
+
+    ++_violations;
+    std::cout << file.string() << ':' << token.Line << ": "
+              << Convert::ContextToStr(context) << " name \"" << token.Text
+              << "\" does not match the configured case\n";
+}
+
+void Scanner::printReport() const
+{
+    struct ContextStats
+    {
+        std::size_t Declarations {0};
+        std::size_t Names {0};
+        std::size_t Mismatched {0};
+    };
+
+    std::map<std::string_view, ContextStats> stats;
+
+    // Names that are equal once case and underscores are ignored
+    std::map<std::pair<Contexts, std::string>, std::vector<std::uint64_t>>
+        spellings;
+
+    for (const auto& [key, symbol] : _symbols)
+    {
+        const auto context {static_cast<Contexts>(key >> 32)};
+
+        ContextStats& contextStats {stats[Convert::ContextToStr(context)]};
+        contextStats.Declarations += symbol.Count;
+        ++contextStats.Names;
+        if (!symbol.Matches) ++contextStats.Mismatched;
+
+        std::string folded;
+        for (char c : _names.Lookup(static_cast<InternTable::Id>(key)))
+        {
+            if (c == '_') continue;
+            folded += static_cast<char>(
+                std::tolower(static_cast<unsigned char>(c)));
+        }
+
+        spellings[{context, std::move(folded)}].push_back(key);
+    }
+
+    std::cout << "\nNaming report:\n";
+    for (const auto& [context, contextStats] : stats)
+    {
+        std::cout << "  " << context << ": " << contextStats.Declarations
+                  << " declarations, " << contextStats.Names
+                  << " distinct names, " << contextStats.Mismatched
+                  << " not matching\n";
+    }
+
+    std::cout << "\nInconsistent case across files:\n";
+    for (auto& [group, keys] : spellings)
+    {
+        if (keys.size() < 2) continue;
+
+        // Spellings that all first appear in one file are left to review
+        // of that file
+        const std::uint32_t firstFile {_symbols.at(keys.front()).FirstFile};
+        if (std::ranges::all_of(keys, [&](std::uint64_t key) {
+                return _symbols.at(key).FirstFile == firstFile;
+            }))
+            continue;
+
+        std::ranges::sort(keys, {}, [this](std::uint64_t key) {
+            return _names.Lookup(static_cast<InternTable::Id>(key));
+        });
+
+        std::cout << "  " << Convert::ContextToStr(group.first) << ':';
+        for (std::uint64_t key : keys)
+        {
+            const auto name {_names.Lookup(static_cast<InternTable::Id>(key))};
+            const auto& firstFile {_reportFiles[_symbols.at(key).FirstFile]};
+
+            std::cout << " \"" << name << "\" (" << firstFile.string() << ')';
+        }
+        std::cout << '\n';
+    }
+}
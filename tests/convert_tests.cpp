@@ -0,0 +1,111 @@
+/**
+ * @file convert_tests.cpp
+ * @author Luke Houston (Romket) (lukehouston08@gmail.com)
+ * @brief tests for the Convert class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 Luke Houston
+ *
+ * This file is part of ccase-check.  ccase-check is free software:
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as publishedby the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <convert.h>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+TEST(CaseNameToRegex, CamelCase)
+{
+    auto pattern {Convert::CaseNameToRegex("CamelCase")};
+
+    EXPECT_TRUE(std::regex_match("fooBar", pattern));
+    EXPECT_TRUE(std::regex_match("foo2", pattern));
+    EXPECT_FALSE(std::regex_match("FooBar", pattern));
+    EXPECT_FALSE(std::regex_match("foo_bar", pattern));
+}
+
+TEST(CaseNameToRegex, PascalCase)
+{
+    auto pattern {Convert::CaseNameToRegex("PascalCase")};
+
+    EXPECT_TRUE(std::regex_match("FooBar", pattern));
+    EXPECT_FALSE(std::regex_match("fooBar", pattern));
+    EXPECT_FALSE(std::regex_match("Foo_Bar", pattern));
+}
+
+TEST(CaseNameToRegex, SnakeCase)
+{
+    auto pattern {Convert::CaseNameToRegex("SnakeCase")};
+
+    EXPECT_TRUE(std::regex_match("foo_bar", pattern));
+    EXPECT_TRUE(std::regex_match("foo", pattern));
+    EXPECT_FALSE(std::regex_match("fooBar", pattern));
+    EXPECT_FALSE(std::regex_match("_foo", pattern));
+}
+
+TEST(CaseNameToRegex, ScreamingSnakeCase)
+{
+    auto pattern {Convert::CaseNameToRegex("ScreamingSnakeCase")};
+
+    EXPECT_TRUE(std::regex_match("FOO_BAR", pattern));
+    EXPECT_FALSE(std::regex_match("Foo_Bar", pattern));
+}
+
+TEST(CaseNameToRegex, KebabAndFlatCase)
+{
+    auto kebab {Convert::CaseNameToRegex("KebabCase")};
+    auto flat {Convert::CaseNameToRegex("FlatCase")};
+
+    EXPECT_TRUE(std::regex_match("foo-bar", kebab));
+    EXPECT_TRUE(std::regex_match("foobar", flat));
+    EXPECT_FALSE(std::regex_match("fooBar", flat));
+}
+
+TEST(CaseNameToRegex, UnknownNameIsUsedAsRegex)
+{
+    auto pattern {Convert::CaseNameToRegex("m_[a-z]+")};
+
+    EXPECT_TRUE(std::regex_match("m_foo", pattern));
+    EXPECT_FALSE(std::regex_match("foo", pattern));
+}
+
+TEST(CaseNameToRegex, InvalidRegexThrows)
+{
+    EXPECT_THROW(Convert::CaseNameToRegex("[a-z"), std::regex_error);
+}
+
+TEST(StrToContext, KnownContexts)
+{
+    EXPECT_EQ(Convert::StrToContext("classDef"), Contexts::cClass);
+    EXPECT_EQ(Convert::StrToContext("macroDef"), Contexts::cMacro);
+    EXPECT_EQ(Convert::StrToContext("privateVar"), Contexts::cPrivateVariable);
+}
+
+TEST(StrToContext, UnknownContextThrows)
+{
+    EXPECT_THROW(Convert::StrToContext("classdef"), std::invalid_argument);
+    EXPECT_THROW(Convert::StrToContext(""), std::invalid_argument);
+}
+
+TEST(ContextToStr, RoundTrips)
+{
+    for (std::string_view name : {"classDef", "structDef", "enumDef",
+                                  "namespaceDef", "globalFunc", "publicVar"})
+    {
+        EXPECT_EQ(Convert::ContextToStr(Convert::StrToContext(name)), name);
+    }
+}
@@ -0,0 +1,72 @@
+/**
+ * @file intern_table_tests.cpp
+ * @author Luke Houston (Romket) (lukehouston08@gmail.com)
+ * @brief tests for the InternTable class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 Luke Houston
+ *
+ * This file is part of ccase-check.  ccase-check is free software:
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as publishedby the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <intern_table.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(InternTable, SameStringSameId)
+{
+    InternTable table;
+
+    auto foo {table.Intern("foo")};
+    auto bar {table.Intern("bar")};
+
+    EXPECT_NE(foo, bar);
+    EXPECT_EQ(table.Intern(std::string {"foo"}), foo);
+    EXPECT_EQ(table.Lookup(foo), "foo");
+    EXPECT_EQ(table.Lookup(bar), "bar");
+    EXPECT_EQ(table.Size(), 2u);
+}
+
+TEST(InternTable, ConcurrentInterning)
+{
+    constexpr std::size_t threadCount {8};
+    constexpr std::size_t nameCount {2000};
+
+    InternTable                                table;
+    std::vector<std::vector<InternTable::Id>> ids(threadCount);
+
+    {
+        std::vector<std::jthread> threads;
+        for (std::size_t t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&, t] {
+                for (std::size_t i = 0; i < nameCount; ++i)
+                    ids[t].push_back(table.Intern("name" + std::to_string(i)));
+            });
+        }
+    }
+
+    EXPECT_EQ(table.Size(), nameCount);
+
+    for (std::size_t t = 1; t < threadCount; ++t) EXPECT_EQ(ids[t], ids[0]);
+
+    for (std::size_t i = 0; i < nameCount; ++i)
+        EXPECT_EQ(table.Lookup(ids[0][i]), "name" + std::to_string(i));
+}
@@ -0,0 +1,213 @@
+/**
+ * @file lexer_tests.cpp
+ * @author Luke Houston (Romket) (lukehouston08@gmail.com)
+ * @brief tests for the Lexer class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 Luke Houston
+ *
+ * This file is part of ccase-check.  ccase-check is free software:
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as publishedby the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <lexer.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct OwnedToken
+    {
+        Token::Kind Type;
+        std::string Text;
+        std::size_t Line;
+        char        Prev;
+        char        Between;
+
+        bool operator==(const OwnedToken&) const = default;
+    };
+
+    std::vector<OwnedToken> lex(std::string_view source,
+                                std::size_t      chunkSize = 0)
+    {
+        if (chunkSize == 0) chunkSize = source.size() + 1;
+
+        std::vector<OwnedToken> tokens;
+        const Lexer::TokenCallback onToken {[&](const Token& token) {
+            tokens.push_back({token.Type, std::string {token.Text}, token.Line,
+                              token.Prev, token.Between});
+        }};
+
+        Lexer lexer;
+        for (std::size_t i = 0; i < source.size(); i += chunkSize)
+            lexer.Feed(source.substr(i, chunkSize), onToken);
+        lexer.Finish(onToken);
+
+        return tokens;
+    }
+
+    std::vector<std::string> texts(const std::vector<OwnedToken>& tokens)
+    {
+        std::vector<std::string> result;
+        for (const auto& token : tokens) result.push_back(token.Text);
+        return result;
+    }
+
+    constexpr std::string_view sample {
+        "#include <vector>\n"
+        "#  define MAX_SIZE 0x1F'FFull\n"
+        "// class Commented\n"
+        "/* struct Hidden * / */ template<class T> class MyClass : Base\n"
+        "{\n"
+        "    const char* s = \"enum \\\" Quoted\";\n"
+        "    char c = '\\'';\n"
+        "    enum class Color { eRed };\n"
+        "};\n"
+        "a/b;"};
+} // namespace
+
+TEST(Lexer, EmitsIdentifiers)
+{
+    EXPECT_EQ(texts(lex("int fooBar = _baz2;")),
+              (std::vector<std::string> {"int", "fooBar", "_baz2"}));
+}
+
+TEST(Lexer, SkipsCommentsLiteralsAndNumbers)
+{
+    EXPECT_EQ(texts(lex(sample)),
+              (std::vector<std::string> {"include", "vector", "define",
+                                         "MAX_SIZE", "template", "class", "T",
+                                         "class", "MyClass", "Base", "const",
+                                         "char", "s", "char", "c", "enum",
+                                         "class", "Color", "eRed", "a", "b"}));
+}
+
+TEST(Lexer, MarksDirectives)
+{
+    auto tokens {lex(sample)};
+
+    EXPECT_EQ(tokens[0].Type, Token::Kind::directive);
+    EXPECT_EQ(tokens[1].Type, Token::Kind::identifier);
+    EXPECT_EQ(tokens[2].Type, Token::Kind::directive);
+    EXPECT_EQ(tokens[3].Type, Token::Kind::identifier);
+
+    EXPECT_EQ(lex("a # define")[1].Type, Token::Kind::identifier);
+}
+
+TEST(Lexer, TracksLinesAndPreviousCharacter)
+{
+    auto tokens {lex("class A\n{\n    int b;\n};")};
+
+    ASSERT_EQ(tokens.size(), 4u);
+    EXPECT_EQ(tokens[0].Line, 1u);
+    EXPECT_EQ(tokens[0].Prev, '\0');
+    EXPECT_EQ(tokens[1].Prev, 's');
+    EXPECT_EQ(tokens[2].Line, 3u);
+    EXPECT_EQ(tokens[2].Prev, '{');
+    EXPECT_EQ(tokens[3].Prev, 't');
+}
+
+TEST(Lexer, TracksFirstCharacterBetweenTokens)
+{
+    auto tokens {lex("sizeof(struct tm) /* c */ ;x\n"
+                     "struct stat // c\n"
+                     "  st")};
+
+    ASSERT_EQ(tokens.size(), 7u);
+    EXPECT_EQ(tokens[0].Between, '\0');
+    EXPECT_EQ(tokens[1].Between, '(');
+    EXPECT_EQ(tokens[2].Between, '\0');
+    EXPECT_EQ(tokens[3].Between, ')');
+    EXPECT_EQ(tokens[5].Between, '\0');
+    EXPECT_EQ(tokens[6].Between, '\0');
+
+    const Lexer::TokenCallback ignore {[](const Token&) {}};
+
+    Lexer lexer;
+    lexer.Feed("a /", ignore);
+    EXPECT_EQ(lexer.Finish(ignore), '/');
+    lexer.Feed("a ; b", ignore);
+    EXPECT_EQ(lexer.Finish(ignore), '\0');
+    lexer.Feed("a {", ignore);
+    EXPECT_EQ(lexer.Finish(ignore), '{');
+}
+
+TEST(Lexer, ChunkBoundariesDoNotChangeOutput)
+{
+    const auto expected {lex(sample)};
+
+    for (std::size_t chunkSize = 1; chunkSize <= sample.size(); ++chunkSize)
+    {
+        EXPECT_EQ(lex(sample, chunkSize), expected)
+            << "chunk size " << chunkSize;
+    }
+}
+
+TEST(Lexer, FinishFlushesTrailingIdentifierAndResets)
+{
+    std::vector<std::string> seen;
+    const Lexer::TokenCallback onToken {
+        [&](const Token& token) { seen.emplace_back(token.Text); }};
+
+    Lexer lexer;
+    lexer.Feed("/* unterminated", onToken);
+    lexer.Finish(onToken);
+    lexer.Feed("foo", onToken);
+    lexer.Feed("Bar", onToken);
+    lexer.Finish(onToken);
+
+    EXPECT_EQ(seen, (std::vector<std::string> {"fooBar"}));
+}
+
+TEST(Lexer, UnterminatedLiteralsEndAtNewline)
+{
+    constexpr std::string_view source {"#error don't include this\n"
+                                       "class bad2;\n"
+                                       "char* s = \"open\n"
+                                       "struct bad3;"};
+
+    const auto tokens {lex(source)};
+
+    EXPECT_EQ(texts(tokens),
+              (std::vector<std::string> {"error", "don", "class", "bad2",
+                                         "char", "s", "struct", "bad3"}));
+    EXPECT_EQ(tokens[2].Line, 2u);
+    EXPECT_EQ(tokens[7].Line, 4u);
+}
+
+TEST(Lexer, SkipsRawStrings)
+{
+    constexpr std::string_view source {
+        "auto s = R\"(a \"b)\";\n"
+        "class bad1;\n"
+        "auto t = u8R\"x(struct Hidden )\" )x\";\n"
+        "auto u = R\"y(\n"
+        "enum Multi\n"
+        ")y\"; Rest"};
+
+    const auto tokens {lex(source)};
+
+    EXPECT_EQ(texts(tokens),
+              (std::vector<std::string> {"auto", "s", "class", "bad1", "auto",
+                                         "t", "auto", "u", "Rest"}));
+    EXPECT_EQ(tokens[8].Line, 6u);
+    EXPECT_EQ(tokens[8].Prev, ';');
+
+    for (std::size_t chunkSize = 1; chunkSize <= source.size(); ++chunkSize)
+        EXPECT_EQ(lex(source, chunkSize), tokens) << "chunk size " << chunkSize;
+}
@@ -0,0 +1,194 @@
+/**
+ * @file parse_args_tests.cpp
+ * @author Luke Houston (Romket) (lukehouston08@gmail.com)
+ * @brief tests for the Parser class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 Luke Houston
+ *
+ * This file is part of ccase-check.  ccase-check is free software:
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as publishedby the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "test_utils.h"
+
+#include <parse_args.h>
+
+#include <gtest/gtest.h>
+
+class CommandLine : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        _config = _dir.Write(".ccase-check", "classDef: PascalCase\n");
+        _source = _dir.Write("src/a.cpp", "class Foo {};\n");
+    }
+
+    std::string configArg() const { return "--config=" + _config.string(); }
+
+    TempDir               _dir;
+    std::filesystem::path _config;
+    std::filesystem::path _source;
+};
+
+TEST_F(CommandLine, NoInput)
+{
+    Args args {"ccase-check"};
+
+    auto result {Parser::CommandLine(args.Argc(), args.Argv())};
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().Type, Error::ErrType::noInput);
+}
+
+TEST_F(CommandLine, PathsAndDefaults)
+{
+    Args args {"ccase-check", configArg(), _source.string(),
+               _dir.Path().string()};
+
+    auto result {Parser::CommandLine(args.Argc(), args.Argv())};
+
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->ConfigPath, _config);
+    EXPECT_EQ(result->ToScan,
+              (std::vector<std::filesystem::path> {_source, _dir.Path()}));
+    EXPECT_EQ(result->MaxFileSize, 0u);
+    EXPECT_FALSE(result->SampleOversized);
+    EXPECT_FALSE(result->Report);
+}
+
+TEST_F(CommandLine, MissingScanPath)
+{
+    Args args {"ccase-check", configArg(),
+               (_dir.Path() / "missing.cpp").string()};
+
+    auto result {Parser::CommandLine(args.Argc(), args.Argv())};
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().Type, Error::ErrType::scanPathDNE);
+}
+
+TEST_F(CommandLine, MissingConfig)
+{
+    Args args {"ccase-check",
+               "--config=" + (_dir.Path() / "missing").string(),
+               _source.string()};
+
+    auto result {Parser::CommandLine(args.Argc(), args.Argv())};
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().Type, Error::ErrType::configPathDNE);
+}
+
+TEST_F(CommandLine, ConfigIsDirectory)
+{
+    Args args {"ccase-check", "--config=" + _dir.Path().string(),
+               _source.string()};
+
+    auto result {Parser::CommandLine(args.Argc(), args.Argv())};
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().Type, Error::ErrType::configPathNotFile);
+}
+
+TEST_F(CommandLine, UnknownOption)
+{
+    Args args {"ccase-check", configArg(), "--frobnicate", _source.string()};
+
+    auto result {Parser::CommandLine(args.Argc(), args.Argv())};
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().Type, Error::ErrType::unknownOption);
+    EXPECT_EQ(result.error().Info, "--frobnicate");
+}
+
+TEST_F(CommandLine, HelpWithOtherArguments)
+{
+    Args args {"ccase-check", "--help", _source.string()};
+
+    auto result {Parser::CommandLine(args.Argc(), args.Argv())};
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().Type, Error::ErrType::extraOptions);
+}
+
+TEST_F(CommandLine, ScanOptions)
+{
+    Args args {"ccase-check",          configArg(),  "--max-file-size=2M",
+               "--sample-oversized",   "--report",   "--chunk-size=4096",
+               _source.string()};
+
+    auto result {Parser::CommandLine(args.Argc(), args.Argv())};
+
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->MaxFileSize, 2u << 20);
+    EXPECT_TRUE(result->SampleOversized);
+    EXPECT_TRUE(result->Report);
+    EXPECT_EQ(result->ChunkSize, 4096u);
+}
+
+TEST_F(CommandLine, InvalidSizes)
+{
+    for (std::string option : {"--max-file-size=", "--max-file-size=12Q",
+                               "--max-file-size=-1", "--chunk-size=0",
+                               "--chunk-size=K",
+                               "--max-file-size=17179869184G"})
+    {
+        Args args {"ccase-check", configArg(), option, _source.string()};
+
+        auto result {Parser::CommandLine(args.Argc(), args.Argv())};
+
+        ASSERT_FALSE(result) << option;
+        EXPECT_EQ(result.error().Type, Error::ErrType::invalidSize) << option;
+    }
+}
+
+TEST_F(CommandLine, IoOptions)
+{
+    Args args {"ccase-check", configArg(), "--io=uring", "--io-window=8",
+               _source.string()};
+
+    auto result {Parser::CommandLine(args.Argc(), args.Argv())};
+
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->Io, IoMode::uring);
+    EXPECT_EQ(result->IoWindow, 8u);
+}
+
+TEST_F(CommandLine, InvalidIoMode)
+{
+    Args args {"ccase-check", configArg(), "--io=mmap", _source.string()};
+
+    auto result {Parser::CommandLine(args.Argc(), args.Argv())};
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().Type, Error::ErrType::invalidIoMode);
+}
+
+TEST_F(CommandLine, InvalidIoWindow)
+{
+    for (std::string option : {"--io-window=", "--io-window=0",
+                               "--io-window=4K", "--io-window=-2"})
+    {
+        Args args {"ccase-check", configArg(), option, _source.string()};
+
+        auto result {Parser::CommandLine(args.Argc(), args.Argv())};
+
+        ASSERT_FALSE(result) << option;
+        EXPECT_EQ(result.error().Type, Error::ErrType::invalidIoWindow)
+            << option;
+    }
+}
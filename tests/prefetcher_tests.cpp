@@ -0,0 +1,143 @@
+/**
+ * @file prefetcher_tests.cpp
+ * @author Luke Houston (Romket) (lukehouston08@gmail.com)
+ * @brief tests for the Prefetcher implementations
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 Luke Houston
+ *
+ * This file is part of ccase-check.  ccase-check is free software:
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as publishedby the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "test_utils.h"
+
+#include <prefetcher.h>
+
+#include <gtest/gtest.h>
+
+class PrefetcherTest : public testing::TestWithParam<IoMode>
+{
+protected:
+    void SetUp() override
+    {
+        if (GetParam() == IoMode::uring && UringUnavailable())
+            GTEST_SKIP() << "io_uring is unavailable";
+    }
+};
+
+TEST(Prefetcher, SyncHasNoPrefetcher)
+{
+    EXPECT_EQ(Prefetcher::Create(IoMode::sync, 8), nullptr);
+}
+
+TEST_P(PrefetcherTest, ReturnsFilesInOrder)
+{
+    TempDir                            dir;
+    std::vector<std::filesystem::path> files;
+    for (int i = 0; i < 100; ++i)
+    {
+        const std::string contents(static_cast<std::size_t>(i),
+                                   static_cast<char>('a' + i % 26));
+        files.push_back(dir.Write(std::to_string(i) + ".h", contents));
+    }
+
+    CaptureCout capture;
+    auto        prefetcher {Prefetcher::Create(GetParam(), 8)};
+    ASSERT_NE(prefetcher, nullptr);
+
+    std::size_t next {0};
+    for (const auto& file : files)
+    {
+        if (prefetcher->Full())
+        {
+            PrefetchedFile popped {prefetcher->Pop()};
+            EXPECT_EQ(popped.Path, files[next]);
+            EXPECT_EQ(popped.Contents.size(), next);
+            ++next;
+        }
+
+        prefetcher->Push(file, std::filesystem::file_size(file), false);
+    }
+
+    while (!prefetcher->Empty())
+    {
+        PrefetchedFile popped {prefetcher->Pop()};
+        ASSERT_TRUE(popped.Loaded);
+        EXPECT_EQ(popped.Path, files[next]);
+        EXPECT_EQ(popped.Contents,
+                  std::string(next, static_cast<char>('a' + next % 26)));
+        ++next;
+    }
+
+    EXPECT_EQ(next, files.size());
+}
+
+TEST_P(PrefetcherTest, ReadsAtMostSize)
+{
+    TempDir dir;
+    auto    file {dir.Write("a.h", "class Foo;\n")};
+
+    CaptureCout capture;
+    auto        prefetcher {Prefetcher::Create(GetParam(), 4)};
+
+    prefetcher->Push(file, 5, true);
+    PrefetchedFile popped {prefetcher->Pop()};
+
+    EXPECT_TRUE(popped.Loaded);
+    EXPECT_TRUE(popped.Truncated);
+    EXPECT_EQ(popped.Contents, "class");
+}
+
+TEST_P(PrefetcherTest, MissingFileIsNotLoaded)
+{
+    TempDir dir;
+
+    CaptureCout capture;
+    auto        prefetcher {Prefetcher::Create(GetParam(), 4)};
+
+    prefetcher->Push(dir.Path() / "missing.h", 10, false);
+    EXPECT_FALSE(prefetcher->Pop().Loaded);
+}
+
+// Opening a directory works on POSIX, but reading it fails with EISDIR
+TEST_P(PrefetcherTest, ReadErrorIsNotLoaded)
+{
+    TempDir dir;
+
+    CaptureCout capture;
+    auto        prefetcher {Prefetcher::Create(GetParam(), 4)};
+
+    prefetcher->Push(dir.Path(), 10, false);
+    EXPECT_FALSE(prefetcher->Pop().Loaded);
+}
+
+TEST_P(PrefetcherTest, DestroyWithFilesInFlight)
+{
+    TempDir dir;
+
+    CaptureCout capture;
+    auto        prefetcher {Prefetcher::Create(GetParam(), 16)};
+
+    for (int i = 0; i < 16; ++i)
+        prefetcher->Push(dir.Write(std::to_string(i), "struct A;"), 9, false);
+}
+
+INSTANTIATE_TEST_SUITE_P(IoModes, PrefetcherTest,
+                         testing::Values(IoMode::pread, IoMode::uring),
+                         [](const auto& info) {
+                             return info.param == IoMode::pread ? "pread"
+                                                                : "uring";
+                         });
@@ -0,0 +1,270 @@
+/**
+ * @file scanner_tests.cpp
+ * @author Luke Houston (Romket) (lukehouston08@gmail.com)
+ * @brief tests for the Scanner class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 Luke Houston
+ *
+ * This file is part of ccase-check.  ccase-check is free software:
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as publishedby the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "test_utils.h"
+
+#include <scanner.h>
+
+#include <gtest/gtest.h>
+
+class ScannerTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        _info.ConfigPath = _dir.Write(".ccase-check",
+                                      "classDef: PascalCase\n"
+                                      "structDef: PascalCase\n"
+                                      "namespaceDef: SnakeCase\n"
+                                      "macroDef: ScreamingSnakeCase\n");
+    }
+
+    int run()
+    {
+        CaptureCout capture;
+
+        Scanner scanner {std::move(_info)};
+        int     result {scanner.Run()};
+
+        _output = capture.Str();
+        return result;
+    }
+
+    TempDir     _dir;
+    ScanInfo    _info;
+    std::string _output;
+};
+
+TEST_F(ScannerTest, CleanFile)
+{
+    _info.ToScan.push_back(_dir.Write("a.h", "#define MAX_SIZE 4\n"
+                                             "namespace my_lib\n"
+                                             "{\n"
+                                             "    class Widget;\n"
+                                             "    struct alignas(8) Point;\n"
+                                             "}\n"));
+
+    EXPECT_EQ(run(), 0);
+    EXPECT_EQ(_output, "");
+}
+
+TEST_F(ScannerTest, ReportsMismatchedNames)
+{
+    _info.ToScan.push_back(_dir.Write("a.h", "#define maxSize 4\n"
+                                             "class widget;\n"
+                                             "struct [[nodiscard]] point;\n"));
+
+    EXPECT_EQ(run(), 1);
+    EXPECT_NE(_output.find("a.h:1: macroDef name \"maxSize\""),
+              std::string::npos);
+    EXPECT_NE(_output.find("a.h:2: classDef name \"widget\""),
+              std::string::npos);
+    EXPECT_NE(_output.find("a.h:3: structDef name \"point\""),
+              std::string::npos);
+}
+
+TEST_F(ScannerTest, IgnoresNonDeclarations)
+{
+    _info.ToScan.push_back(_dir.Write("a.h", "using namespace std;\n"
+                                             "template<class t> class Box;\n"
+                                             "struct { int x; } anon;\n"
+                                             "enum class Color : int {};\n"
+                                             "// class lowercase\n"));
+
+    EXPECT_EQ(run(), 0) << _output;
+}
+
+TEST_F(ScannerTest, SkipsExportMacros)
+{
+    _info.ToScan.push_back(
+        _dir.Write("a.h", "class FOO_API Widget final : Base {};\n"
+                          "struct FOO_API point {\n"
+                          "};\n"
+                          "#define FOO_API EXPORT\n"
+                          "class LAST_ONE;"));
+
+    EXPECT_EQ(run(), 1);
+    EXPECT_NE(_output.find("a.h:2: structDef name \"point\""),
+              std::string::npos);
+    EXPECT_NE(_output.find("a.h:5: classDef name \"LAST_ONE\""),
+              std::string::npos);
+    EXPECT_EQ(_output.find("FOO_API"), std::string::npos) << _output;
+    EXPECT_EQ(_output.find("EXPORT"), std::string::npos) << _output;
+}
+
+TEST_F(ScannerTest, IgnoresTypeUses)
+{
+    _info.ToScan.push_back(
+        _dir.Write("a.c", "struct stat st;\n"
+                          "int n = sizeof(struct tm);\n"
+                          "void f(struct stat* s, struct addr& a);\n"
+                          "struct FILE_HEADER header;\n"
+                          "std::vector<struct item> items;\n"
+                          "struct sockaddr_in addr = {0};\n"
+                          "enum color c;\n"
+                          "struct stat"));
+
+    EXPECT_EQ(run(), 0);
+    EXPECT_EQ(_output, "");
+}
+
+TEST_F(ScannerTest, ScansDirectoriesRecursively)
+{
+    _dir.Write("src/nested/b.h", "class bad;\n");
+    _info.ToScan.push_back(_dir.Path() / "src");
+
+    EXPECT_EQ(run(), 1);
+    EXPECT_NE(_output.find("\"bad\""), std::string::npos);
+}
+
+TEST_F(ScannerTest, SmallChunksMatchWholeFile)
+{
+    _info.ToScan.push_back(_dir.Write("a.h", "class LongClassName;\n"
+                                             "class anotherLongName;\n"));
+    _info.ChunkSize = 3;
+
+    EXPECT_EQ(run(), 1);
+    EXPECT_NE(_output.find("a.h:2: classDef name \"anotherLongName\""),
+              std::string::npos);
+    EXPECT_EQ(_output.find("LongClassName"), std::string::npos);
+}
+
+TEST_F(ScannerTest, SkipsOversizedFiles)
+{
+    _info.ToScan.push_back(
+        _dir.Write("a.h", "class Fine;\nclass bad;\n"));
+    _info.MaxFileSize = 12;
+
+    EXPECT_EQ(run(), 0);
+    EXPECT_NE(_output.find("Skipping"), std::string::npos);
+}
+
+TEST_F(ScannerTest, SkipNoticeFollowsPrefetchedFiles)
+{
+    _dir.Write("src/a.h", "class bad;\n");
+    _dir.Write("src/b.h", std::string(100, ' ') + "class big;\n");
+    _info.ToScan.push_back(_dir.Path() / "src" / "a.h");
+    _info.ToScan.push_back(_dir.Path() / "src" / "b.h");
+    _info.MaxFileSize = 64;
+    _info.Io          = IoMode::pread;
+
+    EXPECT_EQ(run(), 1);
+    EXPECT_LT(_output.find("\"bad\""), _output.find("Skipping")) << _output;
+}
+
+TEST_F(ScannerTest, SamplesOversizedFiles)
+{
+    _info.ToScan.push_back(
+        _dir.Write("a.h", "class bad;\nclass alsoBad;\n"));
+    _info.MaxFileSize     = 11;
+    _info.SampleOversized = true;
+
+    EXPECT_EQ(run(), 1);
+    EXPECT_NE(_output.find("\"bad\""), std::string::npos);
+    EXPECT_EQ(_output.find("alsoBad"), std::string::npos);
+}
+
+TEST_F(ScannerTest, ReportFlagsInconsistentCase)
+{
+    _info.ToScan.push_back(_dir.Write("a.h", "class HttpClient;\n"));
+    _info.ToScan.push_back(_dir.Write("b.h", "class HTTPClient;\n"
+                                             "class HttpClient;\n"));
+    _info.Report = true;
+
+    EXPECT_EQ(run(), 0);
+    EXPECT_NE(_output.find("classDef: 3 declarations, 2 distinct names, 0 "
+                           "not matching"),
+              std::string::npos);
+
+    const std::string expected {
+        "\"HTTPClient\" (" + (_dir.Path() / "b.h").string() +
+        ") \"HttpClient\" (" + (_dir.Path() / "a.h").string() + ")"};
+
+    EXPECT_NE(_output.find(expected), std::string::npos);
+}
+
+TEST_F(ScannerTest, ReportSkipsSameFileSpellings)
+{
+    _info.ToScan.push_back(_dir.Write("a.h", "class HttpClient;\n"
+                                             "class HTTPClient;\n"));
+    _info.Report = true;
+
+    EXPECT_EQ(run(), 0);
+    EXPECT_NE(_output.find("Inconsistent case across files:\n"),
+              std::string::npos);
+    EXPECT_EQ(_output.find("\"HTTPClient\""), std::string::npos) << _output;
+}
+
+TEST_F(ScannerTest, RejectsDuplicateConfigKeys)
+{
+    _info.ConfigPath = _dir.Write("dup", "classDef: PascalCase\n"
+                                         "classDef: CamelCase\n");
+    _info.ToScan.push_back(_dir.Write("a.h", "class Fine;\n"));
+
+    EXPECT_NE(run(), 0);
+    EXPECT_NE(_output.find("Duplicate argument classDef"), std::string::npos);
+}
+
+class ScannerIoTest : public ScannerTest,
+                      public testing::WithParamInterface<IoMode>
+{
+};
+
+TEST_P(ScannerIoTest, MatchesSync)
+{
+    if (GetParam() == IoMode::uring && UringUnavailable())
+        GTEST_SKIP() << "io_uring is unavailable";
+
+    for (int i = 0; i < 50; ++i)
+    {
+        _dir.Write("src/" + std::to_string(i) + ".h",
+                   i % 3 == 0 ? "class bad" + std::to_string(i) + ";\n"
+                              : "class Good;\n");
+    }
+
+    // Larger than one chunk, so it is streamed between prefetched files
+    _dir.Write("src/25big.h", std::string(100, ' ') + "class big;\n");
+
+    _info.ToScan.push_back(_dir.Path() / "src");
+    _info.ChunkSize = 64;
+    _info.IoWindow  = 4;
+
+    const ScanInfo base {_info};
+
+    EXPECT_EQ(run(), 1);
+    const std::string expected {_output};
+
+    _info    = base;
+    _info.Io = GetParam();
+
+    EXPECT_EQ(run(), 1);
+    EXPECT_EQ(_output, expected);
+}
+
+INSTANTIATE_TEST_SUITE_P(IoModes, ScannerIoTest,
+                         testing::Values(IoMode::pread, IoMode::uring),
+                         [](const auto& info) {
+                             return info.param == IoMode::pread ? "pread"
+                                                                : "uring";
+                         });
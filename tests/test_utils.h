@@ -0,0 +1,120 @@
+/**
+ * @file test_utils.h
+ * @author Luke Houston (Romket) (lukehouston08@gmail.com)
+ * @brief helpers shared between test files
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 Luke Houston
+ *
+ * This file is part of ccase-check.  ccase-check is free software:
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as publishedby the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <prefetcher.h>
+
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class TempDir
+{
+public:
+    TempDir()
+    {
+        std::random_device device;
+
+        _path = std::filesystem::temp_directory_path() /
+                ("ccase-check-test-" + std::to_string(device()));
+        std::filesystem::create_directories(_path);
+    }
+
+    ~TempDir()
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(_path, ec);
+    }
+
+    TempDir(const TempDir&)            = delete;
+    TempDir& operator=(const TempDir&) = delete;
+
+    const std::filesystem::path& Path() const { return _path; }
+
+    std::filesystem::path Write(std::string_view name,
+                                std::string_view contents) const
+    {
+        std::filesystem::path file {_path / name};
+        std::filesystem::create_directories(file.parent_path());
+
+        std::ofstream stream {file, std::ios::binary};
+        stream << contents;
+
+        return file;
+    }
+
+private:
+    std::filesystem::path _path;
+};
+
+// Redirects std::cout into a string for as long as it is alive
+class CaptureCout
+{
+public:
+    CaptureCout() : _old {std::cout.rdbuf(_captured.rdbuf())} {}
+    ~CaptureCout() { std::cout.rdbuf(_old); }
+
+    CaptureCout(const CaptureCout&)            = delete;
+    CaptureCout& operator=(const CaptureCout&) = delete;
+
+    std::string Str() const { return _captured.str(); }
+
+private:
+    std::ostringstream _captured;
+    std::streambuf*    _old;
+};
+
+// Owns the storage for an argc/argv pair
+class Args
+{
+public:
+    Args(std::initializer_list<std::string> args) : _args {args}
+    {
+        for (auto& arg : _args) _argv.push_back(arg.data());
+    }
+
+    int    Argc() { return static_cast<int>(_argv.size()); }
+    char** Argv() { return _argv.data(); }
+
+private:
+    std::vector<std::string> _args;
+    std::vector<char*>       _argv;
+};
+
+// True if Prefetcher::Create prints its notice and falls back to pread, in
+// which case io_uring tests would only be testing the pread pool again
+inline bool UringUnavailable()
+{
+    CaptureCout capture;
+    Prefetcher::Create(IoMode::uring, 1);
+
+    return capture.Str() == "io_uring is unavailable, falling back to pread\n";
+}
@@ -0,0 +1,178 @@
+/**
+ * @file throughput_tests.cpp
+ * @author Luke Houston (Romket) (lukehouston08@gmail.com)
+ * @brief fails if lexing slows down past a recorded threshold
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 Luke Houston
+ *
+ * This file is part of ccase-check.  ccase-check is free software:
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as publishedby the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "test_utils.h"
+
+#include <lexer.h>
+#include <scanner.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr std::string_view corpusUnit {
+        "#include <vector>\n"
+        "#define BUFFER_SIZE 4096\n"
+        "\n"
+        "/**\n"
+        " * @brief a representative chunk of C++ for lexing\n"
+        " */\n"
+        "namespace my_lib\n"
+        "{\n"
+        "    template<typename T>\n"
+        "    class RingBuffer : public Base\n"
+        "    {\n"
+        "    public:\n"
+        "        // Pushes a value, overwriting the oldest one\n"
+        "        void Push(const T& value) { _data[_head++ % 8] = value; }\n"
+        "\n"
+        "    private:\n"
+        "        std::vector<T> _data;\n"
+        "        std::size_t    _head {0};\n"
+        "        const char*    _name {\"ring \\\"buffer\\\"\"};\n"
+        "        double         _ratio {1.5e-3};\n"
+        "    };\n"
+        "} // namespace my_lib\n"};
+
+    constexpr std::size_t corpusSize {8 << 20};
+    constexpr std::size_t chunkSize {64 * 1024};
+
+    // Writes back and drops the file's cached pages, so the next read has to
+    // go to the disk. A no-op where posix_fadvise is unavailable
+    void evictFromPageCache(const std::filesystem::path& file)
+    {
+#ifndef _WIN32
+        const int fd {::open(file.c_str(), O_RDONLY | O_CLOEXEC)};
+        if (fd < 0) return;
+
+        ::fdatasync(fd);
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fd);
+#endif
+    }
+} // namespace
+
+// MIN_LEX_MBPS depends on the build type (see tests/CMakeLists.txt) unless
+// the CCASE_CHECK_MIN_LEX_MBPS cache variable overrides it
+TEST(Throughput, Lexer)
+{
+    std::string corpus;
+    corpus.reserve(corpusSize + corpusUnit.size());
+    while (corpus.size() < corpusSize) corpus += corpusUnit;
+
+    std::size_t                tokenCount {0};
+    const Lexer::TokenCallback onToken {
+        [&](const Token&) { ++tokenCount; }};
+
+    double best {0};
+    for (int run = 0; run < 3; ++run)
+    {
+        Lexer lexer;
+        auto  start {std::chrono::steady_clock::now()};
+
+        std::string_view view {corpus};
+        for (std::size_t i = 0; i < view.size(); i += chunkSize)
+            lexer.Feed(view.substr(i, chunkSize), onToken);
+        lexer.Finish(onToken);
+
+        std::chrono::duration<double> elapsed {
+            std::chrono::steady_clock::now() - start};
+        best = std::max(best, corpus.size() / elapsed.count() / (1 << 20));
+    }
+
+    RecordProperty("MBps", std::to_string(best));
+
+    EXPECT_GT(tokenCount, 0u);
+    EXPECT_GE(best, MIN_LEX_MBPS) << "lexer throughput " << best << " MB/s";
+}
+
+// Not checked against a threshold, since it depends on the disk; compare the
+// recorded MBps between I/O modes instead. Disabled by default as it is slow
+// and only meaningful on a real disk, run it with
+// --gtest_also_run_disabled_tests --gtest_filter='*ColdScanner*'
+class ScanThroughput : public testing::TestWithParam<IoMode>
+{
+};
+
+TEST_P(ScanThroughput, DISABLED_ColdScanner)
+{
+    constexpr std::size_t fileCount {2000};
+
+    if (GetParam() == IoMode::uring && UringUnavailable())
+        GTEST_SKIP() << "io_uring is unavailable";
+
+    TempDir  dir;
+    ScanInfo info;
+    info.ConfigPath = dir.Write(".ccase-check", "classDef: PascalCase\n");
+    info.ToScan.push_back(dir.Path() / "src");
+    info.Io = GetParam();
+
+    std::vector<std::filesystem::path> files;
+    for (std::size_t i = 0; i < fileCount; ++i)
+    {
+        files.push_back(dir.Write("src/" + std::to_string(i % 20) + "/" +
+                                      std::to_string(i) + ".h",
+                                  corpusUnit));
+    }
+
+    // The prefetcher exists to hide open and read stalls on a cold cache,
+    // which a scan of files that were just written would never see
+    for (const auto& file : files) evictFromPageCache(file);
+
+    CaptureCout capture;
+    Scanner     scanner {std::move(info)};
+
+    auto start {std::chrono::steady_clock::now()};
+    EXPECT_EQ(scanner.Run(), 0);
+    std::chrono::duration<double> elapsed {std::chrono::steady_clock::now() -
+                                           start};
+
+    RecordProperty("MBps",
+                   std::to_string(fileCount * corpusUnit.size() /
+                                  elapsed.count() / (1 << 20)));
+}
+
+INSTANTIATE_TEST_SUITE_P(IoModes, ScanThroughput,
+                         testing::Values(IoMode::sync, IoMode::pread,
+                                         IoMode::uring),
+                         [](const auto& info) {
+                             switch (info.param)
+                             {
+                                 case IoMode::sync: return "sync";
+                                 case IoMode::pread: return "pread";
+                                 case IoMode::uring: return "uring";
+                             }
+                             return "";
+                         });